@@ -0,0 +1,38 @@
+/*
+        Entry points of layer_analysis.C. The macro includes this header itself, so the defaults
+        below are the ones used both from the ROOT prompt and by the compiled layer_analysis executable.
+*/
+
+#ifndef LAYER_ANALYSIS_H
+#define LAYER_ANALYSIS_H
+
+#include <string>
+
+// Plots of one ClusterShapeAnalysis output file.
+// s0-s3 are the theta range, phi range, pT and particle type shown in the legends ("0" leaves one out).
+// memoryLimitMB >= 0 streams the plots directory by directory with the histogram cache capped at
+// memoryLimitMB (0: no cap) and reports the peak RSS of every stage, see runPlotJobs().
+// Plots whose histograms did not change since the last run into outputDir are skipped unless
+// redrawAll is set, see PlotCache. The 3D histograms are drawn with at most lodBins bins per axis,
+// lodBins = 0 draws them at full resolution, see reduce3D(). Returns false if the file could not be
+// read, a plot worker failed or an output could not be written.
+bool layer_analysis(const char *inputFile, std::string s0 = "0", std::string s1 = "0", std::string s2 = "0", std::string s3 = "0", int nJobs = 1, std::string outputDir = "layer_plots", double memoryLimitMB = -1, bool redrawAll = false, int lodBins = 40);
+
+// Per-layer statistics of one file without any plots, as a TTree (or a table for .txt/.tsv).
+// Returns false if the file could not be read or the output could not be written.
+bool layer_stats(const char *inputFile, std::string outputFile = "layer_summary.root");
+
+// Fills the histograms layer_analysis() reads from an event-level cluster ntuple, keeping the clusters
+// inside the theta, phi and pT ranges ("[min,max]", "0": no cut). RDataFrame runs on nThreads threads
+// (0: all cores). See bookDetectorHistograms() for the columns and the histograms.
+bool layer_fill(const char* ntupleFile, std::string histogramFile, std::string theta = "0", std::string phi = "0", std::string pT = "0", std::string treeName = "clusters", int nThreads = 0);
+
+// Synthetic MyClusterShapeAnalysis/clusters_* file for benchmarks, the same arguments give the same file
+bool layer_generate(const char* outputFile, int nLayers = 9, int nBins = 100, int nBins3D = 50, long long nEntries = 10000, unsigned seed = 1);
+
+// Plots and per-layer summaries of every file of a scan manifest, see readManifest().
+// memoryLimitMB, redrawAll and lodBins apply to every file as in layer_analysis().
+// Returns false if any file of the scan failed.
+bool layer_sweep(const char* manifest, std::string scanLabel = "P_{T} [GeV]", std::string outputDir = "sweep_plots", int nJobs = 1, double memoryLimitMB = -1, bool redrawAll = false, int lodBins = 40);
+
+#endif
@@ -0,0 +1,139 @@
+/*
+        Command line front end of layer_analysis.C, so the analysis can run as a compiled program
+        instead of an interpreted ROOT macro.
+*/
+
+#include "layer_analysis.h"
+
+#include <getopt.h>
+#include <sys/stat.h>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+static void usage(const char* program){
+    std::cerr << "Usage: " << program << " [options] <input.root>\n"
+              << "       " << program << " [options] --sweep <manifest>\n"
+              << "       " << program << " --stats <output> <input.root>\n"
+              << "       " << program << " [options] --ntuple TREE <ntuple.root>\n"
+              << "\n"
+              << "  -o, --output DIR        output directory (default layer_plots, sweep_plots with --sweep)\n"
+              << "  -t, --theta RANGE       theta range shown in the legends, e.g. \"[72,108]\" (with --ntuple also a cut)\n"
+              << "  -p, --phi RANGE         phi range shown in the legends (with --ntuple also a cut)\n"
+              << "  -P, --pt VALUE          pT shown in the legends, e.g. \"10 GeV\" (with --ntuple a cut if it is a range \"[5,20]\")\n"
+              << "  -n, --particle NAME     particle type shown in the legends, e.g. Muon\n"
+              << "  -j, --jobs N            number of plot workers (default 1)\n"
+              << "      --stream            stream the plots directory by directory and report peak RSS per stage\n"
+              << "  -m, --memory-limit MB   stream and cap the histogram cache of every worker at MB\n"
+              << "  -s, --sweep MANIFEST    process every file of a scan manifest\n"
+              << "      --lod-bins N        bins per axis of the drawn 3D histograms (default 40, 0: full resolution)\n"
+              << "  -f, --force             redraw every plot, also those whose histograms did not change\n"
+              << "  -x, --scan-label LABEL  axis title of the scan variable in sweep mode (default \"P_{T} [GeV]\")\n"
+              << "  -N, --ntuple TREE       the input is an event-level cluster ntuple: fill the histograms from TREE with RDataFrame\n"
+              << "      --threads N         RDataFrame threads for --ntuple (default 0: all cores)\n"
+              << "      --stats FILE        only write the per-layer statistics to FILE (.root, or .txt/.tsv), no plots\n"
+              << "  -h, --help              show this help\n";
+}
+
+int main(int argc, char** argv){
+    // "0" leaves the label out of the legends, as in the macro
+    std::string theta = "0";
+    std::string phi = "0";
+    std::string pt = "0";
+    std::string particle = "0";
+    std::string outputDir;
+    std::string manifest;
+    std::string statsFile;
+    std::string scanLabel = "P_{T} [GeV]";
+    std::string ntupleTree;
+    int nJobs = 1;
+    int nThreads = 0;
+    int lodBins = 40;
+    double memoryLimitMB = -1;
+    bool redrawAll = false;
+
+    static struct option options[] = {
+        {"output",       required_argument, nullptr, 'o'},
+        {"theta",        required_argument, nullptr, 't'},
+        {"phi",          required_argument, nullptr, 'p'},
+        {"pt",           required_argument, nullptr, 'P'},
+        {"particle",     required_argument, nullptr, 'n'},
+        {"jobs",         required_argument, nullptr, 'j'},
+        {"stream",       no_argument,       nullptr, 'S'},
+        {"memory-limit", required_argument, nullptr, 'm'},
+        {"sweep",        required_argument, nullptr, 's'},
+        {"lod-bins",     required_argument, nullptr, 'L'},
+        {"force",        no_argument,       nullptr, 'f'},
+        {"scan-label",   required_argument, nullptr, 'x'},
+        {"stats",        required_argument, nullptr, 'T'},
+        {"ntuple",       required_argument, nullptr, 'N'},
+        {"threads",      required_argument, nullptr, 'R'},
+        {"help",         no_argument,       nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "o:t:p:P:n:j:m:s:fx:N:h", options, nullptr)) != -1) {
+        switch (opt) {
+            case 'o': outputDir = optarg; break;
+            case 't': theta = optarg; break;
+            case 'p': phi = optarg; break;
+            case 'P': pt = optarg; break;
+            case 'n': particle = optarg; break;
+            case 'j': nJobs = atoi(optarg); break;
+            case 'S': if (memoryLimitMB < 0) memoryLimitMB = 0; break;
+            case 'm': memoryLimitMB = atof(optarg); break;
+            case 's': manifest = optarg; break;
+            case 'L': lodBins = atoi(optarg); break;
+            case 'f': redrawAll = true; break;
+            case 'x': scanLabel = optarg; break;
+            case 'T': statsFile = optarg; break;
+            case 'N': ntupleTree = optarg; break;
+            case 'R': nThreads = atoi(optarg); break;
+            case 'h': usage(argv[0]); return 0;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if (nJobs < 1) {
+        std::cerr << "--jobs needs a positive number" << std::endl;
+        return 1;
+    }
+    if (memoryLimitMB < 0 && memoryLimitMB != -1) {
+        std::cerr << "--memory-limit needs a positive number of MB" << std::endl;
+        return 1;
+    }
+
+    if (lodBins < 0) {
+        std::cerr << "--lod-bins needs a positive number, or 0 for full resolution" << std::endl;
+        return 1;
+    }
+    if (nThreads < 0) {
+        std::cerr << "--threads needs a positive number, or 0 for all cores" << std::endl;
+        return 1;
+    }
+
+    if (!manifest.empty()) {
+        if (optind != argc || !ntupleTree.empty()) {
+            usage(argv[0]);
+            return 1;
+        }
+        return layer_sweep(manifest.c_str(), scanLabel, outputDir.empty() ? "sweep_plots" : outputDir, nJobs, memoryLimitMB, redrawAll, lodBins) ? 0 : 1;
+    }
+
+    if (optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string input = argv[optind];
+    if (!ntupleTree.empty()) {
+        // Fill the histograms of the ClusterShapeAnalysis job from the ntuple, then go on as usual
+        std::string histogramDir = outputDir.empty() ? "layer_plots" : outputDir;
+        mkdir(histogramDir.c_str(), 0777);
+        input = histogramDir + "/ntuple_histograms.root";
+        if (!layer_fill(argv[optind], input, theta, phi, pt, ntupleTree, nThreads)) return 1;
+    }
+    if (!statsFile.empty()) {
+        return layer_stats(input.c_str(), statsFile) ? 0 : 1;
+    }
+    return layer_analysis(input.c_str(), theta, phi, pt, particle, nJobs, outputDir.empty() ? "layer_plots" : outputDir, memoryLimitMB, redrawAll, lodBins) ? 0 : 1;
+}
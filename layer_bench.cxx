@@ -0,0 +1,120 @@
+/*
+        Benchmark of layer_analysis on synthetic input: generates a file with layer_generate(), draws
+        every plot of it --repeat times from scratch and once more with the output cache of the last
+        run in place, and prints the wall time and throughput of every run. The same options give the
+        same input, so numbers of different builds can be compared. The per-stage times of the last
+        run are in <output>/plots/profile.txt.
+*/
+
+#include "layer_analysis.h"
+
+#include <getopt.h>
+#include <sys/stat.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+static void usage(const char* program){
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "\n"
+              << "  -o, --output DIR        benchmark directory (default layer_bench)\n"
+              << "  -l, --layers N          layers per histogram family (default 9)\n"
+              << "  -b, --bins N            bins per axis of the 1D and 2D histograms (default 100)\n"
+              << "  -B, --bins3d N          bins per axis of the 3D histograms (default 50)\n"
+              << "  -e, --entries N         entries per histogram (default 10000)\n"
+              << "      --seed N            random seed of the synthetic input (default 1)\n"
+              << "  -j, --jobs N            number of plot workers (default 1)\n"
+              << "      --lod-bins N        bins per axis of the drawn 3D histograms (default 40, 0: full resolution)\n"
+              << "  -r, --repeat N          number of runs that draw every plot (default 3)\n"
+              << "  -h, --help              show this help\n";
+}
+
+// Number of output files in the "# output" table of a profile report
+static int countOutputs(const std::string& profile){
+    std::ifstream in(profile);
+    std::string line;
+    int outputs = -1;
+    while (std::getline(in, line)) {
+        if (line.compare(0, 8, "# output") == 0) outputs = 0;
+        else if (outputs >= 0 && !line.empty() && line[0] != '#') outputs++;
+    }
+    return outputs < 0 ? 0 : outputs;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv){
+    std::string outputDir = "layer_bench";
+    int nLayers = 9;
+    int nBins = 100;
+    int nBins3D = 50;
+    long long nEntries = 10000;
+    unsigned seed = 1;
+    int nJobs = 1;
+    int repeat = 3;
+    int lodBins = 40;
+
+    static struct option options[] = {
+        {"output",       required_argument, nullptr, 'o'},
+        {"layers",       required_argument, nullptr, 'l'},
+        {"bins",         required_argument, nullptr, 'b'},
+        {"bins3d",       required_argument, nullptr, 'B'},
+        {"entries",      required_argument, nullptr, 'e'},
+        {"seed",         required_argument, nullptr, 'S'},
+        {"jobs",         required_argument, nullptr, 'j'},
+        {"repeat",       required_argument, nullptr, 'r'},
+        {"lod-bins",     required_argument, nullptr, 'L'},
+        {"help",         no_argument,       nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "o:l:b:B:e:j:r:h", options, nullptr)) != -1) {
+        switch (opt) {
+            case 'o': outputDir = optarg; break;
+            case 'l': nLayers = atoi(optarg); break;
+            case 'b': nBins = atoi(optarg); break;
+            case 'B': nBins3D = atoi(optarg); break;
+            case 'e': nEntries = atoll(optarg); break;
+            case 'S': seed = strtoul(optarg, nullptr, 10); break;
+            case 'j': nJobs = atoi(optarg); break;
+            case 'r': repeat = atoi(optarg); break;
+            case 'L': lodBins = atoi(optarg); break;
+            case 'h': usage(argv[0]); return 0;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if (optind != argc || nLayers < 1 || nBins < 1 || nBins3D < 1 || nEntries < 0 || nJobs < 1 || repeat < 1 || lodBins < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    mkdir(outputDir.c_str(), 0777);
+    std::string input = outputDir + "/synthetic.root";
+    std::string plotsDir = outputDir + "/plots";
+    std::string profile = plotsDir + "/profile.txt";
+
+    auto start = std::chrono::steady_clock::now();
+    if (!layer_generate(input.c_str(), nLayers, nBins, nBins3D, nEntries, seed)) return 1;
+    double generateTime = secondsSince(start);
+    struct stat info;
+    double inputMB = stat(input.c_str(), &info) == 0 ? info.st_size / (1024. * 1024.) : 0;
+    std::cout << "input " << input << ": " << inputMB << " MB (layers " << nLayers << ", bins " << nBins << ", 3D bins " << nBins3D
+              << ", entries " << nEntries << ", seed " << seed << "), generated in " << generateTime << " s" << std::endl;
+
+    for (int run = 1; run <= repeat + 1; run++) {
+        bool cached = run > repeat;
+        start = std::chrono::steady_clock::now();
+        if (!layer_analysis(input.c_str(), "0", "0", "0", "0", nJobs, plotsDir, -1, !cached, lodBins)) return 1;
+        double seconds = secondsSince(start);
+        int outputs = countOutputs(profile);
+        std::cout << (cached ? "cached rerun" : "run " + std::to_string(run)) << ": " << seconds << " s, " << nJobs << " worker(s), 3D drawn with "
+                  << (lodBins > 0 ? std::to_string(lodBins) + " bins per axis" : "full resolution") << ", "
+                  << outputs << " outputs written, " << outputs / seconds << " outputs/s, " << inputMB / seconds << " MB/s of input" << std::endl;
+    }
+    return 0;
+}
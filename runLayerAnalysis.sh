@@ -1,8 +1,35 @@
 #!/bin/bash
 
+# Number of plot workers, -j N
+jobs=1
+# Sweep manifest, -m manifest.txt (one "file | scan value | theta | phi | pT | particle" per line)
+manifest=""
+while getopts "j:m:" opt; do
+    case $opt in
+        j) jobs="$OPTARG" ;;
+        m) manifest="$OPTARG" ;;
+        *) echo "Usage: $0 [-j N] <parameter>"; echo "       $0 [-j N] -m <manifest>"; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+# Use the compiled executable when it has been built (cmake -S . -B build && cmake --build build)
+exe="$(dirname "$0")/build/layer_analysis"
+
+# Whole scan in one ROOT session
+if [ -n "$manifest" ]; then
+    if [ -x "$exe" ]; then
+        "$exe" -j "$jobs" --sweep "$manifest"
+        exit $?
+    fi
+    root -l -e ".L layer_analysis.C" -e "layer_sweep(\"$manifest\", \"P_{T} [GeV]\", \"sweep_plots\", $jobs)"
+    exit $?
+fi
+
 # Check if at least one argument is provided
 if [ $# -eq 0 ]; then
-    echo "Usage: $0 <parameter>"
+    echo "Usage: $0 [-j N] <parameter>"
+    echo "       $0 [-j N] -m <manifest>"
     exit 1
 fi
 
@@ -10,4 +37,9 @@ fi
 rootFile="$1"
 tdr="$2"
 
-root -l "layer_analysis.C(\"$rootFile\", \"[72,108]\", \"Rand\", \"10 GeV\", \"Muon\")"
+if [ -x "$exe" ]; then
+    "$exe" -j "$jobs" --theta "[72,108]" --phi "Rand" --pt "10 GeV" --particle "Muon" "$rootFile"
+    exit $?
+fi
+
+root -l "layer_analysis.C(\"$rootFile\", \"[72,108]\", \"Rand\", \"10 GeV\", \"Muon\", $jobs)"